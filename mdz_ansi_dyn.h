@@ -14,12 +14,18 @@
  * Capacity - how many bytes of memory is reserved for string content.
  * Size - how many characters are actually residing in a string.
  *
- * "reserve" functions allocate/reallocate memory dynamically using malloc()/realloc().
+ * mdz_ansi_dyn_create(), mdz_ansi_dyn_insert() and mdz_ansi_dyn_replace() allocate/reallocate memory dynamically using malloc()/realloc() functions set in mdz_ansi_dyn_setAllocFunctions().
  * "attach" functionality allows attaching contiguous block of memory to string, for using string functions on it.
  *
  * \par portability
  * Source code of library conforms to ANSI C 89/90 Standard.
  *
+ * \par thread-safety
+ * mdz_ansi_dyn_init() and mdz_ansi_dyn_setAllocFunctions() change library-wide state. Call them before other threads start using the library, and not concurrently with any other library function.
+ * mdz_ansi_dyn_find(), mdz_ansi_dyn_rfind(), mdz_ansi_dyn_firstOf(), mdz_ansi_dyn_firstNotOf(), mdz_ansi_dyn_lastOf(), mdz_ansi_dyn_lastNotOf() and mdz_ansi_dyn_replace() also change library-wide (license) state, if nRightPos - nLeftPos > 90000000.
+ * Thus concurrent calls of library functions - including functions taking const string, and calls on different strings - are not guaranteed to be race-free in this release.
+ * Library does not synchronize access to strings. A string must not be passed to a non-const function while any other thread is using the same string.
+ *
  * \version 0.1
  *
  * \date 2024-10
@@ -525,7 +531,8 @@ extern "C"
    * MDZ_ERROR_BIGCOUNT   - nCount is bigger than compare area (between nLeftPos and Size)
    * MDZ_ERROR_NONE       - function succeeded
    * \return:
-   * MDZ_COMPARE_EQUAL or MDZ_COMPARE_NONEQUAL - Result of comparison
+   * MDZ_ANSI_COMPARE_EQUAL or MDZ_ANSI_COMPARE_NONEQUAL - Result of comparison
+   * MDZ_ANSI_COMPARE_ERROR                              - if error happened
    */
   enum mdz_ansi_compare_result mdz_ansi_dyn_compare(const mdz_AnsiDyn* psAnsi, size_t nLeftPos, const char* pcItems, size_t nCount, mdz_bool bPartialCompare, enum mdz_error* penError);
 